@@ -1,14 +1,37 @@
+#include <atomic>
+#include <cctype>
 #include <chrono>
+#include <cmath>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
 #include <cstdlib>
+#include <cstring>
 #include <ctime>
+#include <fstream>
 #include <iomanip>
 #include <iostream>
-#include <limits>
+#include <list>
 #include <map>
+#include <mutex>
 #include <random>
+#include <sstream>
 #include <string>
 #include <thread>
+#include <unordered_map>
 #include <vector>
+#include <fcntl.h>
+#ifdef _WIN32
+#include <conio.h>
+#include <io.h>
+#include <sys/stat.h>
+#else
+#include <cerrno>
+#include <csignal>
+#include <termios.h>
+#include <unistd.h>
+#endif
 using namespace std;
 
 // Base: Physical Attack Set
@@ -197,10 +220,38 @@ struct Enemy : public Entity {
     Enemy() // Default Constructor
         : Entity("Enemy", 1, 5.0, 1.0, 0, 0.5, 0.5) {}
 
-    Enemy(string name, int level, int health, double physical_damage, double magic_damage, double armor, double magic_resist)
+    Enemy(string name, int level, double health, double physical_damage, double magic_damage, double armor, double magic_resist)
         : Entity(name, level, health, physical_damage, magic_damage, armor, magic_resist) {}
 };
 
+// Combat: Damage of a Move against a Target
+static double calculateMoveDamage(const PhysicalAttack& attack, const Entity& target, bool isCrit) {
+    // Base Damage
+    double base_physical_damage = attack.physical_damage_dealt;
+    double base_magic_damage = attack.magic_damage_dealt;
+
+    // Flat Reduction
+    double flat_reduced_armor = target.armor - attack.flat_armor_penetration;
+    double flat_reduced_magic_resist = target.magic_resist - attack.flat_magic_penetration;
+
+    // Percent Reduction
+    double percent_reduced_armor = target.armor * attack.percent_armor_penetration;
+    double percent_reduced_magic_resist = target.magic_resist * attack.percent_magic_penetration;
+
+    double total_damage; // Total Damage
+
+    if (isCrit) { // Crit Damage
+        total_damage = ((base_physical_damage - (flat_reduced_armor - percent_reduced_armor))
+                        + (base_magic_damage - (flat_reduced_magic_resist - percent_reduced_magic_resist)))
+                        * attack.critical_damage_multiplier;
+    } else { // Non-Crit Damage
+        total_damage = (base_physical_damage - (flat_reduced_armor - percent_reduced_armor))
+                        + (base_magic_damage - (flat_reduced_magic_resist - percent_reduced_magic_resist));
+    }
+
+    return total_damage;
+}
+
 static vector<Enemy> difficulty1Enemies;
 static vector<Enemy> difficulty2Enemies;
 static vector<Enemy> difficulty3Enemies;
@@ -208,13 +259,1016 @@ static vector<Enemy> difficulty4Enemies;
 static vector<Enemy> difficulty5Enemies;
 static vector<Enemy> bosses;
 
+// Lock-Free Ring: Single Producer, Single Consumer
+template <typename T, size_t Capacity>
+struct SpscRing {
+    static_assert((Capacity & (Capacity - 1)) == 0, "Capacity must be a power of two");
+
+    // Producer Only: false if Full
+    bool push(const T& item) {
+        size_t current_tail = tail.load(memory_order_relaxed);
+        if (current_tail - head.load(memory_order_acquire) == Capacity) {
+            return false;
+        }
+        buffer[current_tail & (Capacity - 1)] = item;
+        tail.store(current_tail + 1, memory_order_release);
+        return true;
+    }
+
+    // Consumer Only: false if Empty
+    bool pop(T& item) {
+        size_t current_head = head.load(memory_order_relaxed);
+        if (current_head == tail.load(memory_order_acquire)) {
+            return false;
+        }
+        item = buffer[current_head & (Capacity - 1)];
+        head.store(current_head + 1, memory_order_release);
+        return true;
+    }
+
+    // Either Side: Items queued, may be stale by the time it returns
+    size_t size() const {
+        return tail.load(memory_order_acquire) - head.load(memory_order_acquire);
+    }
+
+    // Consumer Only: Drop Everything Queued
+    void clear() {
+        head.store(tail.load(memory_order_acquire), memory_order_release);
+    }
+
+private:
+    T buffer[Capacity];
+    alignas(64) atomic<size_t> head{0};
+    alignas(64) atomic<size_t> tail{0};
+};
+
+// Input: Decoded Key Event
+enum class Key { Char, Enter, Backspace, Escape, Up, Down, Left, Right };
+
+struct KeyEvent {
+    Key key;
+    char ch;
+
+    KeyEvent() // Default Constructor
+    : key(Key::Char), ch(0) {}
+
+    KeyEvent(Key k, char c) // Parameterized Constructor
+    : key(k), ch(c) {}
+};
+
+// Input: Raw Terminal Bytes -> Key Events
+struct KeyDecoder {
+    int state = 0; // 0: Normal, 1: After ESC, 2: After ESC [
+    unsigned char pending = 0;
+    bool has_pending = false;
+
+    // Returns true when a complete Key Event is ready
+    bool feed(unsigned char byte, KeyEvent& event) {
+        if (state == 1) {
+            if (byte == '[' || byte == 'O') {
+                state = 2;
+                return false;
+            }
+            state = 0; // Lone ESC, re-read byte as normal input
+            event = {Key::Escape, 0};
+            pending = byte;
+            has_pending = true;
+            return true;
+        }
+        if (state == 2) {
+            if (byte >= 0x20 && byte <= 0x3F) {
+                return false; // Parameter/Intermediate Byte, e.g. "1;5" in ESC [ 1 ; 5 C
+            }
+            state = 0;
+            switch (byte) { // Final Byte, Modifiers ignored
+                case 'A': event = {Key::Up, 0}; return true;
+                case 'B': event = {Key::Down, 0}; return true;
+                case 'C': event = {Key::Right, 0}; return true;
+                case 'D': event = {Key::Left, 0}; return true;
+                default: return false; // Unsupported Sequence
+            }
+        }
+        if (byte == 27) {
+            state = 1;
+            return false;
+        }
+        if (byte == '\n' || byte == '\r') {
+            event = {Key::Enter, 0};
+        } else if (byte == 127 || byte == 8) {
+            event = {Key::Backspace, 0};
+        } else {
+            event = {Key::Char, static_cast<char>(byte)};
+        }
+        return true;
+    }
+
+    // Byte that followed a Lone ESC, still to be decoded
+    bool takePending(KeyEvent& event) {
+        if (!has_pending) {
+            return false;
+        }
+        has_pending = false;
+        return feed(pending, event);
+    }
+
+    // End of a Read: a dangling ESC is the Escape key itself
+    bool flush(KeyEvent& event) {
+        if (state == 1) {
+            state = 0;
+            event = {Key::Escape, 0};
+            return true;
+        }
+        return false;
+    }
+};
+
+// Input: Dedicated Terminal Reader Thread
+struct InputReader {
+    SpscRing<KeyEvent, 256> events;
+
+    void start() {
+        if (started) {
+            return;
+        }
+        started = true;
+        enableRawMode();
+        thread(&InputReader::readLoop, this).detach();
+    }
+
+    // Blocks until the Reader delivers a Key, false once Input is closed and drained
+    bool wait(KeyEvent& event) {
+        unique_lock<mutex> lock(signal_mutex);
+        bool popped = false;
+        key_ready.wait(lock, [&]() {
+            popped = events.pop(event);
+            return popped || closed();
+        });
+        return popped || events.pop(event); // Last Key before EOF
+    }
+
+    // Drop Keys typed while the Game was busy, a Pipe's Keys are all intentional
+    void discardPending() {
+        if (interactive) {
+            events.clear();
+        }
+    }
+
+    // Reader hit EOF, no more Keys will arrive
+    bool closed() const {
+        return finished.load(memory_order_acquire);
+    }
+
+private:
+    bool started = false;
+    bool interactive = true;
+    atomic<bool> finished{false};
+    mutex signal_mutex;
+    condition_variable key_ready;
+
+    // Reader Thread: push, then wake a waiting Game Thread
+    void deliver(const KeyEvent& event) {
+        events.push(event); // Full Ring: drop the Key
+        lock_guard<mutex> lock(signal_mutex);
+        key_ready.notify_one();
+    }
+
+    void close() {
+        finished.store(true, memory_order_release);
+        lock_guard<mutex> lock(signal_mutex);
+        key_ready.notify_one();
+    }
+
+#ifdef _WIN32
+    void enableRawMode() {} // _getch already reads the Console unbuffered
+
+    void readLoop() {
+        while (true) {
+            int ch = _getch();
+            KeyEvent event;
+            if (ch == 0 || ch == 0xE0) { // Extended Key
+                switch (_getch()) {
+                    case 72: event = {Key::Up, 0}; break;
+                    case 80: event = {Key::Down, 0}; break;
+                    case 75: event = {Key::Left, 0}; break;
+                    case 77: event = {Key::Right, 0}; break;
+                    default: continue;
+                }
+            } else if (ch == '\r' || ch == '\n') {
+                event = {Key::Enter, 0};
+            } else if (ch == 8) {
+                event = {Key::Backspace, 0};
+            } else if (ch == 27) {
+                event = {Key::Escape, 0};
+            } else {
+                event = {Key::Char, static_cast<char>(ch)};
+            }
+            deliver(event);
+        }
+    }
+#else
+    static termios& originalTermios() {
+        static termios original;
+        return original;
+    }
+
+    static void restoreTerminal() {
+        tcsetattr(STDIN_FILENO, TCSAFLUSH, &originalTermios());
+    }
+
+    // Ctrl-C & friends skip atexit: restore, then die from the same Signal
+    static void restoreTerminalOnSignal(int sig) {
+        tcsetattr(STDIN_FILENO, TCSAFLUSH, &originalTermios());
+        signal(sig, SIG_DFL);
+        raise(sig);
+    }
+
+    void enableRawMode() {
+        interactive = isatty(STDIN_FILENO);
+        if (!interactive || tcgetattr(STDIN_FILENO, &originalTermios()) == -1) {
+            return; // Piped Input: leave as is
+        }
+        atexit(restoreTerminal);
+        for (int sig : {SIGINT, SIGTERM, SIGHUP, SIGQUIT}) {
+            signal(sig, restoreTerminalOnSignal);
+        }
+
+        termios raw = originalTermios();
+        raw.c_lflag &= ~(ICANON | ECHO); // Byte-at-a-time, no Echo
+        raw.c_cc[VMIN] = 1;
+        raw.c_cc[VTIME] = 0;
+        tcsetattr(STDIN_FILENO, TCSAFLUSH, &raw);
+    }
+
+    void readLoop() {
+        KeyDecoder decoder;
+        unsigned char bytes[64];
+        KeyEvent event;
+
+        while (true) {
+            ssize_t count = read(STDIN_FILENO, bytes, sizeof(bytes));
+            if (count < 0 && errno == EINTR) {
+                continue;
+            }
+            if (count <= 0) {
+                close(); // EOF or Error
+                return;
+            }
+            for (ssize_t i = 0; i < count; i++) {
+                if (decoder.feed(bytes[i], event)) {
+                    deliver(event);
+                }
+                if (decoder.takePending(event)) {
+                    deliver(event);
+                }
+            }
+            if (decoder.flush(event)) {
+                deliver(event);
+            }
+        }
+    }
+#endif
+};
+
+static InputReader input;
+
+// Journal: Combat Event Types
+enum class EventType : uint8_t { Session = 0, MoveUsed = 1, CritRoll = 2, Damage = 3, XpGain = 4, LevelUp = 5 };
+
+// Journal: One Combat Event
+struct CombatEvent {
+    EventType type = EventType::Session;
+    uint64_t timestamp_us = 0; // Session: Wall Clock, Others: since Session Start
+    int64_t first = 0;         // MoveUsed/CritRoll/Damage: Move, XpGain: XP, LevelUp: Level
+    int64_t second = 0;        // MoveUsed: Enemy Level, CritRoll: 0/1, Damage: x100, XpGain: Total XP, LevelUp: Stat
+};
+
+// Journal: Varint Binary Encoding
+// File: "EXJ1", then Records of [varint Length][Type][varint Time Delta][zigzag First][zigzag Second]
+struct JournalCodec {
+    static constexpr char magic[4] = {'E', 'X', 'J', '1'};
+    static constexpr size_t max_record_bytes = 1 + 1 + 10 * 3;
+
+    static void putVarint(unsigned char*& out, uint64_t value) {
+        while (value >= 0x80) {
+            *out++ = static_cast<unsigned char>(value) | 0x80;
+            value >>= 7;
+        }
+        *out++ = static_cast<unsigned char>(value);
+    }
+
+    static bool getVarint(const unsigned char*& in, const unsigned char* end, uint64_t& value) {
+        value = 0;
+        for (int shift = 0; in < end && shift < 64; shift += 7) {
+            unsigned char byte = *in++;
+            value |= static_cast<uint64_t>(byte & 0x7F) << shift;
+            if (!(byte & 0x80)) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    static uint64_t zigzag(int64_t value) {
+        return (static_cast<uint64_t>(value) << 1) ^ static_cast<uint64_t>(value >> 63);
+    }
+
+    static int64_t unzigzag(uint64_t value) {
+        return static_cast<int64_t>(value >> 1) ^ -static_cast<int64_t>(value & 1);
+    }
+
+    // Appends one Record, Timestamps are stored as Deltas
+    static void encode(vector<unsigned char>& out, const CombatEvent& event, uint64_t& last_timestamp) {
+        unsigned char payload[max_record_bytes];
+        unsigned char* cursor = payload;
+        *cursor++ = static_cast<unsigned char>(event.type);
+        putVarint(cursor, event.type == EventType::Session ? event.timestamp_us : event.timestamp_us - last_timestamp);
+        putVarint(cursor, zigzag(event.first));
+        putVarint(cursor, zigzag(event.second));
+        last_timestamp = event.type == EventType::Session ? 0 : event.timestamp_us;
+
+        out.push_back(static_cast<unsigned char>(cursor - payload)); // Always < 128
+        out.insert(out.end(), payload, cursor);
+    }
+};
+
+constexpr char JournalCodec::magic[4];
+
+// Journal: Streaming Decoder, reads large Chunks and never loads the whole File
+struct JournalReader {
+    static constexpr size_t chunk_bytes = 1 << 20;
+
+    explicit JournalReader(const string& path) : file(path, ios::binary), buffer(chunk_bytes) {
+        char header[sizeof(JournalCodec::magic)];
+        valid = file.read(header, sizeof(header)) && memcmp(header, JournalCodec::magic, sizeof(header)) == 0;
+    }
+
+    bool good() const {
+        return valid;
+    }
+
+    // File Length up to the End of the last fully framed Record
+    uint64_t completeBytes() const {
+        return complete_bytes;
+    }
+
+    // Next Event with absolute Session Time, false at End of File or on a truncated Record
+    bool next(CombatEvent& event) {
+        while (valid) {
+            const unsigned char* cursor = buffer.data() + start;
+            const unsigned char* end = buffer.data() + stop;
+            uint64_t length;
+
+            if (JournalCodec::getVarint(cursor, end, length) && static_cast<size_t>(end - cursor) >= length) {
+                const unsigned char* record_end = cursor + length;
+                uint64_t type = length > 0 ? *cursor++ : 0;
+                uint64_t delta, first, second;
+                bool decoded = length > 0
+                    && JournalCodec::getVarint(cursor, record_end, delta)
+                    && JournalCodec::getVarint(cursor, record_end, first)
+                    && JournalCodec::getVarint(cursor, record_end, second);
+                start = static_cast<size_t>(record_end - buffer.data());
+                complete_bytes = buffer_offset + start;
+                if (!decoded) {
+                    continue; // Malformed Record: skip by its Length
+                }
+
+                event.type = static_cast<EventType>(type);
+                timestamp = event.type == EventType::Session ? 0 : timestamp + delta;
+                event.timestamp_us = event.type == EventType::Session ? delta : timestamp;
+                event.first = JournalCodec::unzigzag(first);
+                event.second = JournalCodec::unzigzag(second);
+                return true;
+            }
+
+            if (!refill()) {
+                return false;
+            }
+        }
+        return false;
+    }
+
+    uint64_t bytes_read = 0;
+
+private:
+    ifstream file;
+    vector<unsigned char> buffer;
+    size_t start = 0, stop = 0;
+    uint64_t timestamp = 0;
+    bool valid = false;
+    uint64_t buffer_offset = sizeof(JournalCodec::magic); // File Offset of buffer[0]
+    uint64_t complete_bytes = sizeof(JournalCodec::magic);
+
+    // Keeps the partial Record at the Tail, reads the next Chunk behind it
+    bool refill() {
+        size_t leftover = stop - start;
+        if (leftover == buffer.size()) {
+            return false; // Record larger than a Chunk: corrupt
+        }
+        buffer_offset += start;
+        memmove(buffer.data(), buffer.data() + start, leftover);
+        start = 0;
+        stop = leftover;
+        file.read(reinterpret_cast<char*>(buffer.data()) + stop, buffer.size() - stop);
+        size_t got = static_cast<size_t>(file.gcount());
+        stop += got;
+        bytes_read += got;
+        return got > 0;
+    }
+};
+
+// Journal: Background Writer, the Game Thread only pushes to a Ring
+struct EventJournal {
+    static constexpr size_t batch_bytes = 64 * 1024;
+    static constexpr int flush_interval_ms = 100;
+    static constexpr int sync_interval_ms = 1000;
+    static constexpr size_t ring_capacity = 4096;
+
+    ~EventJournal() {
+        close();
+    }
+
+    bool open(const string& journal_path) {
+        if (running.load()) {
+            return true;
+        }
+        path = journal_path;
+#ifdef _WIN32
+        fd = _open(path.c_str(), _O_WRONLY | _O_CREAT | _O_APPEND | _O_BINARY, _S_IREAD | _S_IWRITE);
+#else
+        fd = ::open(path.c_str(), O_WRONLY | O_CREAT | O_APPEND, 0644);
+#endif
+        if (fd < 0) {
+            return false; // Journal stays disabled
+        }
+
+        failed.store(false);
+        session_start = chrono::steady_clock::now();
+        running.store(true, memory_order_release);
+        writer = thread(&EventJournal::writeLoop, this);
+
+        CombatEvent session;
+        session.timestamp_us = chrono::duration_cast<chrono::microseconds>(
+            chrono::system_clock::now().time_since_epoch()).count();
+        events.push(session);
+        return true;
+    }
+
+    // Game Thread: never blocks, a full Ring drops the Event
+    void record(EventType type, int64_t first, int64_t second) {
+        if (!running.load(memory_order_relaxed) || failed.load(memory_order_relaxed)) {
+            return;
+        }
+        CombatEvent event;
+        event.type = type;
+        event.timestamp_us = chrono::duration_cast<chrono::microseconds>(
+            chrono::steady_clock::now() - session_start).count();
+        event.first = first;
+        event.second = second;
+        if (!events.push(event)) {
+            dropped.fetch_add(1, memory_order_relaxed);
+        } else if (events.size() >= ring_capacity / 2) {
+            wake.notify_one(); // Unlocked: a missed Wake only waits out the Flush Interval
+        }
+    }
+
+    // Drains the Ring, then flushes & syncs
+    void close() {
+        if (!running.exchange(false)) {
+            return;
+        }
+        {
+            lock_guard<mutex> lock(wake_mutex);
+            wake.notify_one();
+        }
+        writer.join();
+#ifdef _WIN32
+        _close(fd);
+#else
+        ::close(fd);
+#endif
+        fd = -1;
+    }
+
+    atomic<uint64_t> dropped{0};
+
+private:
+    SpscRing<CombatEvent, ring_capacity> events;
+    atomic<bool> running{false};
+    atomic<bool> failed{false}; // Write Error: the Tail may hold a partial Record
+    thread writer;
+    mutex wake_mutex;
+    condition_variable wake; // Ring Half Full or Closing
+    int fd = -1;
+    string path;
+    chrono::steady_clock::time_point session_start;
+
+    // A Crash or Disk Error can leave half a Record at the End; cut back to the last whole one
+    void repairTail() {
+#ifdef _WIN32
+        uint64_t size = static_cast<uint64_t>(_lseeki64(fd, 0, SEEK_END));
+#else
+        uint64_t size = static_cast<uint64_t>(lseek(fd, 0, SEEK_END));
+#endif
+        uint64_t keep = 0;
+        if (size > 0) {
+            JournalReader reader(path);
+            CombatEvent event;
+            while (reader.good() && reader.next(event)) {
+            }
+            keep = reader.good() ? reader.completeBytes() : 0; // Torn or foreign Header: start over
+        }
+
+        if (keep < size) {
+#ifdef _WIN32
+            _chsize_s(fd, static_cast<long long>(keep));
+#else
+            if (ftruncate(fd, static_cast<off_t>(keep)) != 0) {
+                failed.store(true);
+                return;
+            }
+#endif
+        }
+        if (keep == 0) {
+            writeAll(reinterpret_cast<const unsigned char*>(JournalCodec::magic), sizeof(JournalCodec::magic));
+        }
+    }
+
+    // Disables the Journal on Error instead of appending past a partial Record
+    void writeAll(const unsigned char* data, size_t size) {
+        if (failed.load()) {
+            return;
+        }
+        while (size > 0) {
+#ifdef _WIN32
+            int written = _write(fd, data, static_cast<unsigned>(size));
+#else
+            ssize_t written = write(fd, data, size);
+            if (written < 0 && errno == EINTR) {
+                continue;
+            }
+#endif
+            if (written <= 0) {
+                failed.store(true); // Disk Error: the next open() repairs the Tail
+                return;
+            }
+            data += written;
+            size -= static_cast<size_t>(written);
+        }
+    }
+
+    void sync() {
+#ifdef _WIN32
+        _commit(fd);
+#else
+        fsync(fd);
+#endif
+    }
+
+    void writeLoop() {
+        vector<unsigned char> batch;
+        batch.reserve(batch_bytes + JournalCodec::max_record_bytes);
+        uint64_t last_timestamp = 0;
+        bool unsynced = false;
+        auto last_flush = chrono::steady_clock::now();
+        auto last_sync = last_flush;
+        CombatEvent event;
+
+        repairTail(); // Before the first Write, while the Game Thread queues Events
+
+        while (true) {
+            bool stopping = !running.load(memory_order_acquire);
+
+            while (events.pop(event)) {
+                JournalCodec::encode(batch, event, last_timestamp);
+                if (batch.size() >= batch_bytes) {
+                    writeAll(batch.data(), batch.size());
+                    batch.clear();
+                    unsynced = true;
+                }
+            }
+
+            auto now = chrono::steady_clock::now();
+            if (!batch.empty() && (stopping || now - last_flush >= chrono::milliseconds(flush_interval_ms))) {
+                writeAll(batch.data(), batch.size());
+                batch.clear();
+                unsynced = true;
+                last_flush = now;
+            }
+            if (unsynced && (stopping || now - last_sync >= chrono::milliseconds(sync_interval_ms))) {
+                sync();
+                unsynced = false;
+                last_sync = now;
+            }
+            if (stopping) {
+                return;
+            }
+
+            unique_lock<mutex> lock(wake_mutex);
+            wake.wait_for(lock, chrono::milliseconds(flush_interval_ms), [&]() {
+                return !running.load(memory_order_acquire) || events.size() >= ring_capacity / 2;
+            });
+        }
+    }
+};
+
+constexpr int EventJournal::flush_interval_ms;
+constexpr int EventJournal::sync_interval_ms;
+
+static EventJournal journal;
+
+// Scaling: Enemies for any Level, hand-written up to the last Tier and extrapolated past it
+struct EnemyScaler {
+    static constexpr size_t cache_tiers = 8;
+    static constexpr double jitter = 0.1; // +/- 10% per Stat
+
+    EnemyScaler() = default;
+    EnemyScaler(const EnemyScaler&) = delete; // Cache Index points into this Instance's List
+    EnemyScaler& operator=(const EnemyScaler&) = delete;
+    EnemyScaler(EnemyScaler&&) = default;
+    EnemyScaler& operator=(EnemyScaler&&) = default;
+
+    // Archetype i is column i of the Tiers; hand_written[k] holds the Enemies of Level k + 1
+    EnemyScaler(const vector<const vector<Enemy>*>& hand_written, uint64_t seed) : seed(seed) {
+        size_t columns = hand_written.empty() ? 0 : hand_written[0]->size();
+        for (size_t i = 0; i < columns; i++) {
+            Archetype type;
+            for (size_t k = 0; k < hand_written.size() && i < hand_written[k]->size(); k++) {
+                type.rows.push_back((*hand_written[k])[i]);
+            }
+
+            // Growth per Level: average Slope across the hand-written Rows
+            const Enemy& first = type.rows.front();
+            const Enemy& last = type.rows.back();
+            double levels = max<size_t>(1, type.rows.size() - 1);
+            type.health_growth = (last.health - first.health) / levels;
+            type.physical_damage_growth = (last.physical_damage - first.physical_damage) / levels;
+            type.magic_damage_growth = (last.magic_damage - first.magic_damage) / levels;
+            archetypes.push_back(type);
+        }
+    }
+
+    size_t archetypeCount() const {
+        return archetypes.size();
+    }
+
+    // Level of the Archetype's first hand-written Row
+    int archetypeLevel(size_t archetype) const {
+        return archetypes[archetype].rows.front().level;
+    }
+
+    // One Enemy per Archetype, generated on first use; valid until the next call
+    const vector<Enemy>& tier(int level) {
+        auto cached = index.find(level);
+        if (cached != index.end()) {
+            tiers.splice(tiers.begin(), tiers, cached->second); // Most Recently Used
+            return cached->second->second;
+        }
+
+        if (tiers.size() >= cache_tiers) { // Evict Least Recently Used
+            index.erase(tiers.back().first);
+            tiers.pop_back();
+        }
+        tiers.emplace_front(level, generateTier(level));
+        index[level] = tiers.begin();
+        return tiers.front().second;
+    }
+
+    // Hand-written Row where one exists, past the last Tier deterministic in (Archetype, Level, Seed)
+    Enemy generate(size_t archetype, int level) const {
+        const Archetype& type = archetypes[archetype];
+        level = max(1, level);
+        if (static_cast<size_t>(level) <= type.rows.size()) {
+            return type.rows[level - 1];
+        }
+
+        // Move Damage ignores Player Stats, so Defenses stay at the last Tier
+        const Enemy& last = type.rows.back();
+        int steps = level - static_cast<int>(type.rows.size());
+        auto stat = [&](int which, double value) {
+            return max(0.0, value * roll(archetype, level, which));
+        };
+
+        return Enemy(titleFor(level) + last.name, level,
+                     stat(0, last.health + type.health_growth * steps),
+                     stat(1, last.physical_damage + type.physical_damage_growth * steps),
+                     stat(2, last.magic_damage + type.magic_damage_growth * steps),
+                     stat(3, last.armor),
+                     stat(4, last.magic_resist));
+    }
+
+private:
+    struct Archetype {
+        vector<Enemy> rows; // rows[k]: hand-written Enemy of Level k + 1
+        double health_growth, physical_damage_growth, magic_damage_growth;
+    };
+
+    uint64_t seed = 0;
+    vector<Archetype> archetypes;
+    list<pair<int, vector<Enemy>>> tiers; // Front: Most Recently Used
+    unordered_map<int, list<pair<int, vector<Enemy>>>::iterator> index;
+
+    vector<Enemy> generateTier(int level) const {
+        vector<Enemy> tier;
+        tier.reserve(archetypes.size());
+        for (size_t i = 0; i < archetypes.size(); i++) {
+            tier.push_back(generate(i, level));
+        }
+        return tier;
+    }
+
+    // SplitMix64 over (Archetype, Level, Seed, Stat) -> [1 - jitter, 1 + jitter]
+    double roll(size_t archetype, int level, int which) const {
+        uint64_t x = seed ^ (archetype * 0x9E3779B97F4A7C15ULL) ^ (static_cast<uint64_t>(level) << 20) ^ static_cast<uint64_t>(which);
+        x += 0x9E3779B97F4A7C15ULL;
+        x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9ULL;
+        x = (x ^ (x >> 27)) * 0x94D049BB133111EBULL;
+        x ^= x >> 31;
+        double unit = (x >> 11) * (1.0 / 9007199254740992.0);
+        return 1.0 - jitter + 2.0 * jitter * unit;
+    }
+
+    // Extrapolated Enemies always carry a Title, so they never share a hand-written Name
+    static string titleFor(int level) {
+        static const string titles[] = {"Veteran ", "Elite ", "Ancient ", "Mythic "};
+        return titles[min(3, (level - 1) / 10)];
+    }
+};
+
+// Balance: One Roster Entry, keyed by Tier & Slot
+struct RosterEntry {
+    string key; // e.g. "D1#0", "B#9"
+    const Enemy* enemy;
+};
+
+// Balance: Win Rate & Expected Turns of one (Move x Enemy) Fight
+struct BalanceCell {
+    string move_key, enemy_key;
+    string move_name, enemy_name;
+    double win_rate = 0;
+    double expected_turns = 0;
+    bool dirty = true;
+};
+
+// Balance: Full Roster Matrix, recomputing only Cells whose Stats changed
+struct BalanceMatrix {
+    static const int format_version = 2;
+    static const int trials = 2000;
+    static const int max_turns = 100;
+
+    string path;
+    vector<BalanceCell> cells;
+    map<string, uint64_t> stat_fingerprints; // Stat Key -> Fingerprint at last Simulation
+    map<string, vector<size_t>> dependents;  // Stat Key -> Cells reading those Stats
+
+    explicit BalanceMatrix(string path) : path(path) {
+        load();
+    }
+
+    static string moveKey(int move) {
+        return "M" + to_string(move);
+    }
+
+    // Simulate every Cell whose Stats changed, returns Cells recomputed
+    int refresh(const Player& player, const vector<RosterEntry>& roster) {
+        // Current Stats
+        map<string, uint64_t> current;
+        current["player"] = fingerprintPlayer(player);
+        for (const auto& pair : player.physical_move) {
+            current[moveKey(pair.first)] = fingerprintMove(pair.second);
+        }
+        for (const auto& entry : roster) {
+            current[entry.key] = fingerprintEnemy(*entry.enemy);
+        }
+
+        // Rebuild Cells, carrying over known Results
+        map<pair<string, string>, BalanceCell> previous;
+        for (const auto& cell : cells) {
+            previous[{cell.move_key, cell.enemy_key}] = cell;
+        }
+        cells.clear();
+        dependents.clear();
+
+        vector<const PhysicalAttack*> cell_moves;
+        vector<const Enemy*> cell_enemies;
+        for (const auto& pair : player.physical_move) {
+            for (const auto& entry : roster) {
+                BalanceCell cell;
+                auto found = previous.find({moveKey(pair.first), entry.key});
+                if (found != previous.end()) {
+                    cell = found->second;
+                }
+                cell.move_key = moveKey(pair.first);
+                cell.enemy_key = entry.key;
+                cell.move_name = pair.second.name;
+                cell.enemy_name = entry.enemy->name;
+
+                size_t index = cells.size();
+                dependents["player"].push_back(index);
+                dependents[cell.move_key].push_back(index);
+                dependents[cell.enemy_key].push_back(index);
+
+                cells.push_back(cell);
+                cell_moves.push_back(&pair.second);
+                cell_enemies.push_back(entry.enemy);
+            }
+        }
+
+        // Dirty only the Cells depending on changed Stats
+        for (const auto& stat : current) {
+            auto known = stat_fingerprints.find(stat.first);
+            if (known == stat_fingerprints.end() || known->second != stat.second) {
+                for (size_t index : dependents[stat.first]) {
+                    cells[index].dirty = true;
+                }
+            }
+        }
+
+        vector<size_t> work;
+        for (size_t i = 0; i < cells.size(); i++) {
+            if (cells[i].dirty) {
+                work.push_back(i);
+            }
+        }
+
+        // Parallel Simulation, one Cell at a time per Worker
+        atomic<size_t> next{0};
+        auto worker = [&]() {
+            for (size_t w = next++; w < work.size(); w = next++) {
+                size_t index = work[w];
+                simulate(cells[index], player.health, *cell_moves[index], *cell_enemies[index]);
+            }
+        };
+        size_t thread_count = max<size_t>(1, min<size_t>(thread::hardware_concurrency(), work.size()));
+        vector<thread> workers;
+        for (size_t t = 1; t < thread_count; t++) {
+            workers.emplace_back(worker);
+        }
+        worker();
+        for (auto& t : workers) {
+            t.join();
+        }
+
+        stat_fingerprints = current;
+        save();
+        return static_cast<int>(work.size());
+    }
+
+    // Monte Carlo: the Player spams one Move, the Enemy hits back (same Rules as startCombat)
+    static void simulate(BalanceCell& cell, double player_health, const PhysicalAttack& attack, const Enemy& enemy) {
+        mt19937 gen(static_cast<uint32_t>(fingerprintMove(attack) ^ fingerprintEnemy(enemy)));
+        uniform_int_distribution<> roll(0, 99);
+        int wins = 0;
+        long total_turns = 0;
+
+        for (int trial = 0; trial < trials; trial++) {
+            double current_player_health = player_health;
+            double current_enemy_health = enemy.health;
+            int turn = 0;
+
+            while (current_player_health > 0 && current_enemy_health > 0 && turn < max_turns) {
+                turn++;
+                bool isCrit = attack.critical_chance > roll(gen);
+                current_enemy_health -= calculateMoveDamage(attack, enemy, isCrit);
+                if (current_enemy_health <= 0) {
+                    wins++;
+                    break;
+                }
+                current_player_health -= enemy.physical_damage;
+            }
+            total_turns += turn;
+        }
+
+        cell.win_rate = static_cast<double>(wins) / trials;
+        cell.expected_turns = static_cast<double>(total_turns) / trials;
+        cell.dirty = false;
+    }
+
+    // Fingerprints: FNV-1a over exactly the Stats a Simulation reads
+    static uint64_t hashValue(uint64_t hash, double value) {
+        unsigned char bytes[sizeof(double)];
+        memcpy(bytes, &value, sizeof(double));
+        for (unsigned char byte : bytes) {
+            hash = (hash ^ byte) * 1099511628211ULL;
+        }
+        return hash;
+    }
+
+    static uint64_t fingerprintPlayer(const Player& player) {
+        return hashValue(14695981039346656037ULL, player.health);
+    }
+
+    static uint64_t fingerprintMove(const PhysicalAttack& attack) {
+        uint64_t hash = 14695981039346656037ULL;
+        for (double value : {attack.physical_damage_dealt, attack.magic_damage_dealt,
+                             attack.flat_armor_penetration, attack.flat_magic_penetration,
+                             attack.percent_armor_penetration, attack.percent_magic_penetration,
+                             attack.critical_chance, attack.critical_damage_multiplier}) {
+            hash = hashValue(hash, value);
+        }
+        return hash;
+    }
+
+    static uint64_t fingerprintEnemy(const Enemy& enemy) {
+        uint64_t hash = 14695981039346656037ULL;
+        for (double value : {enemy.health, enemy.physical_damage, enemy.armor, enemy.magic_resist}) {
+            hash = hashValue(hash, value);
+        }
+        return hash;
+    }
+
+    // Persistence: Results survive between Runs
+    // A File that fails to parse anywhere, or lacks its "end" Line, is dropped whole
+    void load() {
+        ifstream file(path);
+        string line, tag;
+        int version = 0, saved_trials = 0, saved_max_turns = 0;
+        if (!getline(file, line) || !parseLine(line, tag, version, saved_trials, saved_max_turns) || tag != "balance"
+            || version != format_version || saved_trials != trials || saved_max_turns != max_turns) {
+            return; // Missing or Stale: simulate everything
+        }
+
+        map<string, uint64_t> loaded_stats;
+        vector<BalanceCell> loaded_cells;
+        while (getline(file, line)) {
+            istringstream fields(line);
+            fields >> tag;
+            if (tag == "stat") {
+                string key;
+                uint64_t fingerprint;
+                if (!parseLine(line, tag, key, fingerprint)) {
+                    return;
+                }
+                loaded_stats[key] = fingerprint;
+            } else if (tag == "cell") {
+                BalanceCell cell;
+                if (!parseLine(line, tag, cell.move_key, cell.enemy_key, cell.win_rate, cell.expected_turns)) {
+                    return;
+                }
+                cell.dirty = false;
+                loaded_cells.push_back(cell);
+            } else if (tag == "end") {
+                size_t stat_count, cell_count;
+                if (parseLine(line, tag, stat_count, cell_count)
+                    && stat_count == loaded_stats.size() && cell_count == loaded_cells.size()) {
+                    stat_fingerprints = loaded_stats;
+                    cells = loaded_cells;
+                }
+                return;
+            } else {
+                return;
+            }
+        }
+    }
+
+    // Written beside the old File, then renamed over it, so a Crash never leaves a partial File
+    void save() const {
+        string temp_path = path + ".tmp";
+        {
+            ofstream file(temp_path, ios::trunc);
+            file << "balance " << format_version << ' ' << trials << ' ' << max_turns << '\n';
+            for (const auto& stat : stat_fingerprints) {
+                file << "stat " << stat.first << ' ' << stat.second << '\n';
+            }
+            file << setprecision(17);
+            for (const auto& cell : cells) {
+                file << "cell " << cell.move_key << ' ' << cell.enemy_key << ' '
+                     << cell.win_rate << ' ' << cell.expected_turns << '\n';
+            }
+            file << "end " << stat_fingerprints.size() << ' ' << cells.size() << '\n';
+            file.flush();
+            if (!file) {
+                remove(temp_path.c_str());
+                return;
+            }
+        }
+#ifdef _WIN32
+        remove(path.c_str()); // rename() does not replace on Windows
+#endif
+        rename(temp_path.c_str(), path.c_str());
+    }
+
+private:
+    // Whole Line parsed into exactly these Fields, nothing missing or left over
+    template <typename... Fields>
+    static bool parseLine(const string& line, Fields&... fields) {
+        istringstream in(line);
+        bool parsed[] = {static_cast<bool>(in >> fields)...};
+        (void)parsed;
+        return !in.fail() && (in >> ws).eof();
+    }
+};
+
 // Main Class
 class Game {
 private:
     Player player;
     Enemy enemy;
+    EnemyScaler scaler;
 public:
-    Game() : player(0, 5), enemy() {} // Add Player & Enemy
+    Game() : player(0, 5), enemy() { // Add Player & Enemy, Start Input & Journal Threads
+        input.start();
+        journal.open("combat_events.bin");
+    }
 
     // Current Enemy
     int current_enemy = 0;
@@ -232,6 +1286,46 @@ public:
         this_thread::sleep_for(chrono::milliseconds(ms_delay));
     }
 
+    // Next Key from the Input Ring, exits once Input is closed
+    static KeyEvent waitKey() {
+        KeyEvent event;
+        if (!input.wait(event)) {
+            exit(0);
+        }
+        return event;
+    }
+
+    // Enter & Spaces only end a typed Line, they are never an Answer
+    static bool isLineEnd(const KeyEvent& event) {
+        return event.key == Key::Enter || (event.key == Key::Char && isspace(static_cast<unsigned char>(event.ch)));
+    }
+
+    // Wait for the Next Key that answers a Prompt
+    static KeyEvent readKey() {
+        input.discardPending(); // Ignore Keys typed during Animations
+        KeyEvent event;
+        do {
+            event = waitKey();
+        } while (isLineEnd(event));
+        return event;
+    }
+
+    // Single-Key Menu Choice, 0 if not a Digit; Arrows & other Special Keys are skipped
+    static int readChoice() {
+        input.discardPending(); // Ignore Keys typed during Animations
+        KeyEvent event;
+        do {
+            event = waitKey();
+        } while (event.key != Key::Char || isLineEnd(event));
+
+        if (!isdigit(static_cast<unsigned char>(event.ch))) {
+            cout << '\n';
+            return 0;
+        }
+        cout << event.ch << '\n';
+        return event.ch - '0';
+    }
+
     static void populateEnemies() {
         // Skeleton, Slime, Goblin, Wolf, Awakened, Dryad, Elementum, Soldier, Weaver, Mage
         // Difficulty 1 Enemies
@@ -317,12 +1411,7 @@ public:
             cout << "    [2] | Exit\n";
             Entity::displayFormat(20, '-');
             cout << ">> ";
-            cin >> choice;
-
-            if (cin.fail()) {
-                cin.clear();
-                cin.ignore(numeric_limits<streamsize>::max(), '\n');
-            }
+            choice = readChoice();
 
             if (choice < 1 || choice > 2) {
                 validChoice = false;
@@ -338,13 +1427,19 @@ public:
         }
     }
 
+    // Tiers in Level Order, for the Enemy Scaler
+    static vector<const vector<Enemy>*> handWrittenTiers() {
+        return {&difficulty1Enemies, &difficulty2Enemies, &difficulty3Enemies, &difficulty4Enemies, &difficulty5Enemies};
+    }
+
     void startGame() {
         // Preparation
         populateEnemies();
         // RNG for Current Enemy
         random_device rd;
         mt19937 gen(rd());
-        uniform_int_distribution<> dis(0, difficulty1Enemies.size() - 1);
+        scaler = EnemyScaler(handWrittenTiers(), gen());
+        uniform_int_distribution<> dis(0, scaler.archetypeCount() - 1);
         current_enemy = dis(gen);
         // Start Combat
         startCombat(current_enemy);
@@ -362,36 +1457,105 @@ public:
         enemy.showEntityStats();
     }
 
-    bool damageIsCrit(int move) {
-        int chance = rand() % 100; // Crit Chance
-        return player.physical_move[move].critical_chance > chance;
-    }
+    void showEventJournal() {
+        JournalReader reader("combat_events.bin");
+        if (!reader.good()) {
+            cout << "no event journal found.\n";
+            return;
+        }
 
-    double calculateDamage(int move, bool isCrit) {
-        // Base Damage
-        double base_physical_damage = player.physical_move[move].physical_damage_dealt;
-        double base_magic_damage = player.physical_move[move].magic_damage_dealt;
+        // Scan the whole Journal, tallying per Event Type
+        auto start = chrono::steady_clock::now();
+        long sessions = 0, moves = 0, crits = 0, hits = 0, xp = 0, level_ups = 0;
+        double damage = 0;
+        CombatEvent event;
+        while (reader.next(event)) {
+            switch (event.type) {
+            case EventType::Session: sessions++; break;
+            case EventType::MoveUsed: moves++; break;
+            case EventType::CritRoll: crits += event.second; break;
+            case EventType::Damage: hits++; damage += event.second / 100.0; break;
+            case EventType::XpGain: xp += event.first; break;
+            case EventType::LevelUp: level_ups++; break;
+            }
+        }
+        double seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
 
-        // Flat Reduction
-        double flat_reduced_armor = enemy.armor - player.physical_move[move].flat_armor_penetration;
-        double flat_reduced_magic_resist = enemy.magic_resist - player.physical_move[move].flat_magic_penetration;
+        cout << fixed << setprecision(1);
+        cout << setw(26) << "[ EVENT JOURNAL ]\n";
+        Entity::displayFormat(33, '-');
+        cout << setw(20) << "Sessions: " << sessions << '\n';
+        cout << setw(20) << "Moves Used: " << moves << '\n';
+        cout << setw(20) << "Crit Rate: " << (moves ? 100.0 * crits / moves : 0) << "%\n";
+        cout << setw(20) << "Avg Damage: " << (hits ? damage / hits : 0) << '\n';
+        cout << setw(20) << "XP Gained: " << xp << '\n';
+        cout << setw(20) << "Level Ups: " << level_ups << '\n';
+        cout << setw(20) << "Dropped: " << journal.dropped.load() << '\n';
+        Entity::displayFormat(33, '-');
+        cout << "scanned " << reader.bytes_read << " bytes in " << seconds * 1000 << " ms\n";
+    }
 
-        // Percent Reduction
-        double percent_reduced_armor = enemy.armor * player.physical_move[move].percent_armor_penetration;
-        double percent_reduced_magic_resist = enemy.magic_resist * player.physical_move[move].percent_magic_penetration;
+    void showBalanceMatrix() {
+        if (difficulty1Enemies.empty()) {
+            populateEnemies();
+        }
 
-        double total_damage; // Total Damage
+        // Full Roster: every Tier plus Bosses
+        vector<RosterEntry> roster;
+        const pair<string, const vector<Enemy>*> tiers[] = {
+            {"D1", &difficulty1Enemies}, {"D2", &difficulty2Enemies}, {"D3", &difficulty3Enemies},
+            {"D4", &difficulty4Enemies}, {"D5", &difficulty5Enemies}, {"B", &bosses}
+        };
+        for (const auto& tier : tiers) {
+            for (size_t i = 0; i < tier.second->size(); i++) {
+                roster.push_back({tier.first + "#" + to_string(i), &(*tier.second)[i]});
+            }
+        }
 
-        if (isCrit) { // Crit Damage
-            total_damage = ((base_physical_damage - (flat_reduced_armor - percent_reduced_armor))
-                            + (base_magic_damage - (flat_reduced_magic_resist - percent_reduced_magic_resist)))
-                            * player.physical_move[move].critical_damage_multiplier;
-        } else { // Non-Crit Damage
-            total_damage = (base_physical_damage - (flat_reduced_armor - percent_reduced_armor))
-                            + (base_magic_damage - (flat_reduced_magic_resist - percent_reduced_magic_resist));
+        // Scaled Tier the Player currently fights
+        if (scaler.archetypeCount() == 0) {
+            scaler = EnemyScaler(handWrittenTiers(), 0);
+        }
+        vector<Enemy> scaled = scaler.tier(player.level);
+        for (size_t i = 0; i < scaled.size(); i++) {
+            roster.push_back({"L" + to_string(player.level) + "#" + to_string(i), &scaled[i]});
         }
 
-        return total_damage;
+        cout << "computing balance matrix...\n";
+        auto start = chrono::steady_clock::now();
+        BalanceMatrix matrix("balance_matrix.dat");
+        int recomputed = matrix.refresh(player, roster);
+        auto elapsed = chrono::duration_cast<chrono::milliseconds>(chrono::steady_clock::now() - start).count();
+
+        // Rows: Enemies, Columns: Moves (Win % / Expected Turns)
+        size_t move_count = player.physical_move.size();
+        cout << fixed << setprecision(1) << left << setw(28) << "Enemy";
+        for (size_t m = 0; m < move_count; m++) {
+            cout << setw(16) << matrix.cells[m * roster.size()].move_name;
+        }
+        cout << '\n';
+        Entity::displayFormat(28 + 16 * static_cast<int>(move_count), '-');
+        for (size_t e = 0; e < roster.size(); e++) {
+            cout << setw(28) << roster[e].enemy->name;
+            for (size_t m = 0; m < move_count; m++) {
+                const BalanceCell& cell = matrix.cells[m * roster.size() + e];
+                string entry = to_string(static_cast<int>(cell.win_rate * 100 + 0.5)) + "% / ";
+                entry += to_string(static_cast<int>(cell.expected_turns + 0.5)) + "t";
+                cout << setw(16) << entry;
+            }
+            cout << '\n';
+        }
+        Entity::displayFormat(28 + 16 * static_cast<int>(move_count), '-');
+        cout << right << "recomputed " << recomputed << " / " << matrix.cells.size() << " cells in " << elapsed << " ms\n";
+    }
+
+    bool damageIsCrit(int move) {
+        int chance = rand() % 100; // Crit Chance
+        return player.physical_move[move].critical_chance > chance;
+    }
+
+    double calculateDamage(int move, bool isCrit) {
+        return calculateMoveDamage(player.physical_move[move], enemy, isCrit);
     }
 
 
@@ -408,12 +1572,13 @@ public:
         double currentEnemyHealth;
         double total_damage = 0;
         double total_enemy_damage = 0;
+        enemy = scaler.tier(player.level)[current_enemy]; // Scaled to Player's Level
         currentPlayerHealth = player.health;  // Player's health
-        currentEnemyHealth = difficulty1Enemies[current_enemy].health;
+        currentEnemyHealth = enemy.health;
 
         // Encounter
         displayLoadingAnimation(3, 200);
-        cout << player.name << " has encountered a " << difficulty1Enemies[current_enemy].name << "!\n";
+        cout << player.name << " has encountered a " << enemy.name << "!\n";
         delay(200);
         cout << "Preparing for battle";
         displayLoadingAnimation(3, 100);
@@ -425,13 +1590,13 @@ public:
 
             // Enemy Stats
             cout << fixed << setprecision(1);
-            cout << "[ Lvl. " << difficulty1Enemies[current_enemy].level << " " << difficulty1Enemies[current_enemy].name << " ]\n";
-            cout << "[ HP: " << currentEnemyHealth << " / " << difficulty1Enemies[current_enemy].health << " ]\n";
+            cout << "[ Lvl. " << enemy.level << " " << enemy.name << " ]\n";
+            cout << "[ HP: " << currentEnemyHealth << " / " << enemy.health << " ]\n";
             Entity::displayFormat(34, '#');
-            cout << left << setw(11) << "P. Attack: " << difficulty1Enemies[current_enemy].physical_damage << " | ";
-            cout << setw(14) << "M. Attack: " << difficulty1Enemies[current_enemy].magic_damage << '\n';
-            cout << left << setw(11) << "Armor: " << difficulty1Enemies[current_enemy].armor << " | ";
-            cout << left << setw(3) << "Magic Resist: " << difficulty1Enemies[current_enemy].magic_resist << '\n';
+            cout << left << setw(11) << "P. Attack: " << enemy.physical_damage << " | ";
+            cout << setw(14) << "M. Attack: " << enemy.magic_damage << '\n';
+            cout << left << setw(11) << "Armor: " << enemy.armor << " | ";
+            cout << left << setw(3) << "Magic Resist: " << enemy.magic_resist << '\n';
             Entity::displayFormat(34, '#');
             cout << '\n';
 
@@ -453,13 +1618,7 @@ public:
 
             // Move
             cout << ">> ";
-            cin >> move;
-
-            if (cin.fail()) {
-                cin.clear();
-                cin.ignore();
-                invalidMove = true;
-            }
+            move = readChoice();
 
             if (move < 1 || move > 4) {
                 invalidMove = true;
@@ -485,21 +1644,30 @@ public:
                     cout << "[" << count++ << "] || Back\n";
                     Entity::displayFormat(20, '-');
                     cout << ">> ";
-                    cin >> attackMove;
+                    attackMove = readChoice();
 
                     if (attackMove == 5) {
                         system("cls");
                         break;
                     }
 
+                    if (player.physical_move.count(attackMove) == 0) {
+                        cout << "Invalid Move.\n";
+                        system("cls");
+                        break;
+                    }
+
                     // Display Player's Pre-Move Stats
                     Entity::displayFormat(20, '-');
-                    cout << difficulty1Enemies[current_enemy].name << " | HP: " << currentEnemyHealth << " / " << difficulty1Enemies[current_enemy].health << '\n';
+                    cout << enemy.name << " | HP: " << currentEnemyHealth << " / " << enemy.health << '\n';
                     Entity::displayFormat(20, '-');
 
                     string move_name = player.physical_move[attackMove].name;
                     bool isCrit = damageIsCrit(attackMove);
                     total_damage = calculateDamage(attackMove, isCrit);
+                    journal.record(EventType::MoveUsed, attackMove, enemy.level);
+                    journal.record(EventType::CritRoll, attackMove, isCrit);
+                    journal.record(EventType::Damage, attackMove, llround(total_damage * 100));
                     currentEnemyHealth -= total_damage;
                     if (currentEnemyHealth < 0) { currentEnemyHealth = 0; }
 
@@ -512,21 +1680,21 @@ public:
                     cout << "                                                                                         \n";
                     cout << "\033[10;1H";
                     Entity::displayFormat(20, '-');
-                    cout << difficulty1Enemies[current_enemy].name << " | HP: " << currentEnemyHealth << " / " << difficulty1Enemies[current_enemy].health << '\n';
+                    cout << enemy.name << " | HP: " << currentEnemyHealth << " / " << enemy.health << '\n';
                     Entity::displayFormat(20, '-');
                     cout << "\033[13;1H";
 
                     // Display Player's Damage to Enemy
                     if (isCrit) {
-                        cout << move_name << " dealt " << total_damage << " critical damage to " << difficulty1Enemies[current_enemy].name << "!!!";
+                        cout << move_name << " dealt " << total_damage << " critical damage to " << enemy.name << "!!!";
                     } else {
-                        cout << move_name << " dealt " << total_damage << " damage to " << difficulty1Enemies[current_enemy].name << '\n';
+                        cout << move_name << " dealt " << total_damage << " damage to " << enemy.name << '\n';
                     }
                     delay(2000);
 
                     if (currentEnemyHealth <= 0) {
                         system("cls");
-                        cout << difficulty1Enemies[current_enemy].name << " defeated!\n";
+                        cout << enemy.name << " defeated!\n";
                         delay(1000);
                         break;
                     }
@@ -542,10 +1710,10 @@ public:
                     Entity::displayFormat(20, '-');
                     cout << player.name << " | HP: " << currentPlayerHealth << " / " << player.health << '\n';
                     Entity::displayFormat(20, '-');
-                    cout << difficulty1Enemies[current_enemy].name << " attacks!\n";
+                    cout << enemy.name << " attacks!\n";
                     delay(2000);
 
-                    total_enemy_damage = difficulty1Enemies[current_enemy].physical_damage;
+                    total_enemy_damage = enemy.physical_damage;
                     currentPlayerHealth -= total_enemy_damage;
 
                     cout << "\033[11;1H"; // Goto Next Line
@@ -555,7 +1723,7 @@ public:
                     cout << player.name << " | HP: " << currentPlayerHealth << " / " << player.health << '\n';
                     Entity::displayFormat(20, '-');
                     cout << '\n';
-                    cout << difficulty1Enemies[current_enemy].name << " dealt " << total_enemy_damage << " damage\n";
+                    cout << enemy.name << " dealt " << total_enemy_damage << " damage\n";
                     delay(2000);
                     break;
                 }
@@ -585,8 +1753,9 @@ public:
         }
 
         // XP Algorithm
-        int xp_gain = difficulty1Enemies[current_enemy].level * 5;
+        int xp_gain = scaler.archetypeLevel(current_enemy) * 5; // Scaled Enemies keep the hand-written Reward
         player.current_xp += xp_gain;
+        journal.record(EventType::XpGain, xp_gain, player.current_xp);
 
         // Display XP Gain
         cout << player.name << " gained " << xp_gain << " XP!\n";
@@ -604,7 +1773,7 @@ public:
         // Start Combat Again
         random_device rd;
         mt19937 gen(rd());
-        uniform_int_distribution<> dis(0, difficulty1Enemies.size() - 1);
+        uniform_int_distribution<> dis(0, scaler.archetypeCount() - 1);
         current_enemy = dis(gen);
 
         system("cls");
@@ -623,7 +1792,7 @@ public:
 
         //  Get Stat Upgrade
         cout << ">> ";
-        cin >> stat;
+        stat = readChoice();
 
         switch(stat) {
         case 1:
@@ -651,6 +1820,8 @@ public:
             break;
         }
 
+        journal.record(EventType::LevelUp, player.level, stat);
+
         // Display Upgraded Stat
         cout << statName << " upgraded!\n";
         delay(200);
@@ -660,8 +1831,12 @@ public:
     void backToMenu() {
         char choice;
         cout << "Back to Menu[y]?: ";
-        cin >> choice;
-        choice = tolower(choice);
+        KeyEvent event = readKey();
+        choice = event.key == Key::Char ? tolower(event.ch) : 0;
+        if (choice != 0) {
+            cout << choice;
+        }
+        cout << '\n';
 
         if (choice == 'y') {
             system("cls");
@@ -684,14 +1859,11 @@ public:
             cout << "[2] | Show Enemy Stats\n";
             cout << "[3] | Start Combat\n";
             cout << "[4] | Level Up\n";
-            cout << "[5] | Exit\n";
+            cout << "[5] | Balance Matrix\n";
+            cout << "[6] | Event Journal\n";
+            cout << "[7] | Exit\n";
             cout << ">> ";
-            cin >> choice;
-
-            if (cin.fail()) {
-                cin.clear();
-                cin.ignore(numeric_limits<streamsize>::max(), '\n');
-            }
+            choice = readChoice();
 
             system("cls");
             switch(choice) {
@@ -708,6 +1880,12 @@ public:
                 levelUp();
                 break;
             case 5:
+                showBalanceMatrix();
+                break;
+            case 6:
+                showEventJournal();
+                break;
+            case 7:
                 cout << "exit debugging...";
                 exit(0);
                 break;